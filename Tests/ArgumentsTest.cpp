@@ -4,25 +4,11 @@
 
 #include <catch.hpp>
 #include <checked_cmd.h>
+#include "TestArgs.h"
 #include <cstdint>
-#include <cstring>
-
-namespace ArgumentsTest::detail {
-        auto CopyToArgs(std::initializer_list<std::string> const& list){
-            std::vector<std::unique_ptr<char[]>> result;
-            for (auto const &item: list){
-                result.push_back(std::make_unique<char[]>(item.size()+1));
-                std::strncpy(result.back().get(), item.c_str(), item.size()+1);
-            }
-            return result;
-        }
-        auto IntoPtrs(std::vector<std::unique_ptr<char[]>> & args){
-            auto result = new char*[args.size()];
-            std::transform(std::begin(args), std::end(args), result, [](auto & uptr){ return uptr.get();});
-            return result;
-        }
-}
+
 namespace ArgumentsTest {
+    namespace detail = TestArgs;
 
     #define TYPE_SAFE(Type, Name) using Name = CheckedCmdTypesafe::Typesafe<Type, struct TypeTag##Name>;
 
@@ -0,0 +1,142 @@
+#include <catch.hpp>
+#include <checked_cmd.h>
+#include <checked_cmd_registry.h>
+#include "TestArgs.h"
+#include <sstream>
+
+namespace EnumTest {
+    namespace detail {
+        using namespace TestArgs;
+
+        constexpr std::size_t many_count = 2000;
+        constexpr std::size_t many_width = 5;
+
+        // "v0000" ... "v1999"
+        constexpr auto MakeManyStorage(){
+            std::array<char, many_count * many_width> storage{};
+            for (std::size_t i = 0; i < many_count; ++i){
+                storage[i * many_width] = 'v';
+                for (std::size_t digit = 1, rest = i; digit < many_width; ++digit, rest /= 10){
+                    storage[(i + 1) * many_width - digit] = static_cast<char>('0' + rest % 10);
+                }
+            }
+            return storage;
+        }
+
+        template<std::size_t N>
+        constexpr auto MakeManyNames(std::array<char, N> const& storage){
+            std::array<std::string_view, many_count> names{};
+            for (std::size_t i = 0; i < many_count; ++i){
+                names[i] = std::string_view(storage.data() + i * many_width, many_width);
+            }
+            return names;
+        }
+    }
+
+    using namespace CheckedCmd;
+
+    enum class CodecId{H264, Hevc, Av1, Vp9};
+    struct CodecNames{
+        static constexpr std::string_view names[] = {"h264", "hevc", "av1", "vp9"};
+    };
+    struct TypeTagAudioCodec{
+        static constexpr std::string_view short_name = "";
+        static constexpr std::string_view long_name  = "--audio";
+    };
+
+    enum class ManyId : std::uint16_t{};
+    struct ManyNames{
+        static constexpr auto storage = detail::MakeManyStorage();
+        static constexpr auto names   = detail::MakeManyNames(storage);
+    };
+
+    using Codec         = CheckedCmd::Enum<CodecId, CodecNames>;
+    using CodecNoCase   = CheckedCmd::Enum<CodecId, CodecNames, EnumCase::Insensitive>;
+    using Many          = CheckedCmd::Enum<ManyId, ManyNames>;
+    using CmdCodec      = CheckedCmd::Param<Codec>;
+    using CmdOptCodec   = CheckedCmd::Param<std::optional<CodecNoCase>>;
+    using AudioCodec    = CheckedCmdTypesafe::Typesafe<Codec, TypeTagAudioCodec>;
+    using CmdAudioCodec = CheckedCmd::Param<std::optional<AudioCodec>>;
+
+    auto const NoChecks = [](auto const &) { return true; };
+
+    static_assert(Codec::FromString("hevc").value() == Codec(CodecId::Hevc));
+    static_assert(!Codec::FromString("HEVC").has_value());
+    static_assert(CodecNoCase::FromString("HEVC").value() == CodecNoCase(CodecId::Hevc));
+    static_assert(!Codec::FromString("mpeg2").has_value());
+    static_assert(Codec(CodecId::Av1).ToString() == "av1");
+
+    TEST_CASE ("Enum maps every name of a large list") {
+        for (std::size_t i = 0; i < Many::count; ++i) {
+            auto const parsed = Many::FromString(ManyNames::names[i]);
+            REQUIRE(parsed.has_value());
+            CHECK(static_cast<std::size_t>(parsed.value().Get()) == i);
+        }
+        CHECK(!Many::FromString("v2000").has_value());
+        CHECK(!Many::FromString("").has_value());
+    }
+
+    TEST_CASE ("Enum streams") {
+        Codec codec;
+        std::istringstream is("vp9");
+        CHECK(is >> codec);
+        CHECK(codec == Codec(CodecId::Vp9));
+
+        std::istringstream bad("mpeg2");
+        CHECK(!(bad >> codec));
+
+        std::ostringstream os;
+        os << Codec(CodecId::Hevc);
+        CHECK(os.str() == "hevc");
+    }
+
+    TEST_CASE ("Param<Enum>") {
+        auto const config = std::make_tuple(CmdCodec(Hint("codec"), ShortName("-c"), LongName("--codec"),
+                                                     Description("video codec"), NoChecks),
+                                            CmdOptCodec(Hint("codec"), ShortName("-a"), LongName("--alt"),
+                                                        Description(""), NoChecks),
+                                            CmdAudioCodec(Hint("codec"), Description("audio codec"), NoChecks),
+                                            CheckedCmd::Help()
+        );
+
+        SECTION ("known names are accepted") {
+            auto args = detail::CopyToArgs({"prgname", "-c av1", "-a VP9", "--audio=h264"});
+            auto success = ParseCmdArgsTuple(static_cast<int>(args.size()), detail::IntoPtrs(args), config);
+            REQUIRE(success.has_value());
+            CHECK(std::get<CmdAudioCodec>(success.value()).value() == AudioCodec(Codec(CodecId::H264)));
+            CHECK(std::get<CmdCodec>(success.value()).value() == Codec(CodecId::Av1));
+            CHECK(std::get<CmdOptCodec>(success.value()).value() == CodecNoCase(CodecId::Vp9));
+        }
+        SECTION ("unknown names fail") {
+            auto args = detail::CopyToArgs({"prgname", "-c mpeg2"});
+            auto success = ParseCmdArgsTuple(static_cast<int>(args.size()), detail::IntoPtrs(args), config);
+            CHECK(!success.has_value());
+        }
+        SECTION ("help lists the choices") {
+            auto args = detail::CopyToArgs({"prgname", "-c av1", "-h"});
+            auto success = ParseCmdArgsTuple(static_cast<int>(args.size()), detail::IntoPtrs(args), config);
+            REQUIRE(success.has_value());
+            auto const help = std::get<CheckedCmd::Help>(success.value()).GetDescription().Get();
+            CHECK(help.find("video codec (h264|hevc|av1|vp9)") != std::string::npos);
+            CHECK(help.find("audio codec (h264|hevc|av1|vp9)") != std::string::npos);
+        }
+        SECTION ("registry help lists the choices of a wrapped Enum") {
+            Registry registry;
+            auto audio = std::get<CmdAudioCodec>(config);
+            auto help  = std::get<CheckedCmd::Help>(config);
+            REQUIRE(registry.Register(audio));
+            REQUIRE(registry.Register(help));
+            auto args = detail::CopyToArgs({"prgname", "-h"});
+            REQUIRE(registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+            CHECK(help.GetDescription().Get().find("audio codec (h264|hevc|av1|vp9)") != std::string::npos);
+        }
+        SECTION ("registry converts without streams") {
+            Registry registry;
+            auto codec = std::get<CmdCodec>(config);
+            REQUIRE(registry.Register(codec));
+            auto args = detail::CopyToArgs({"prgname", "--codec=hevc"});
+            REQUIRE(registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+            CHECK(codec.value() == Codec(CodecId::Hevc));
+        }
+    }
+}
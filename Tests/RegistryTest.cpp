@@ -0,0 +1,207 @@
+#include <catch.hpp>
+#include <checked_cmd_registry.h>
+#include "TestArgs.h"
+#include <cstdint>
+#include <deque>
+
+namespace RegistryTest {
+    namespace detail = TestArgs;
+
+    using namespace CheckedCmd;
+
+    using HasHeadLine = CheckedCmdTypesafe::Typesafe<bool,        struct TypeTagHasHeadLine>;
+    using OutputFile  = CheckedCmdTypesafe::Typesafe<std::string, struct TypeTagOutputFile>;
+    using InputFile   = CheckedCmdTypesafe::Typesafe<std::string, struct TypeTagInputFile>;
+    using ExcelRow    = CheckedCmdTypesafe::Typesafe<uint16_t,    struct TypeTagExcelRow>;
+    using CsvSep      = CheckedCmdTypesafe::Typesafe<char,        struct TypeTagCsvSep>;
+
+    using CmdHasHeadLine   = CheckedCmd::Flag<HasHeadLine>;
+    using CmdOutputFile    = CheckedCmd::Param<std::optional<OutputFile>>;
+    using CmdInputFile     = CheckedCmd::Arg<InputFile>;
+    using CmdExcelRowLimit = CheckedCmd::Param<ExcelRow>;
+    using CmdCsvSep        = CheckedCmd::Param<CsvSep>;
+
+    auto const NoChecks = [](auto const &) { return true; };
+
+    // Options contributed by two independent plugins.
+    struct CsvPlugin {
+        CmdHasHeadLine has_head_line{ShortName("-H"), LongName("--HasHeadLine"), Description("lol")};
+        CmdCsvSep separator{Hint(""), ShortName("-S"), LongName("--Separator"), Description("lol"), NoChecks};
+        CmdInputFile input_file{Hint("inputfile"), Description("lol"), NoChecks};
+
+        bool Register(Registry& registry) {
+            return registry.Register(has_head_line)
+                && registry.Register(separator)
+                && registry.Register(input_file);
+        }
+    };
+
+    struct ExcelPlugin {
+        CmdExcelRowLimit row_limit{Hint("1..65535"), ShortName("-l"), LongName("--LineLimit"), Description("lol"),
+                                   [](ExcelRow const& row) { return row.Get() > 0; }};
+        CmdOutputFile output_file{Hint("filename"), ShortName("-o"), LongName("--OutPutFile"), Description("lol"),
+                                  [](OutputFile const& file) { return file.Get().size() < 6; }};
+
+        bool Register(Registry& registry) {
+            return registry.Register(row_limit)
+                && registry.Register(output_file);
+        }
+    };
+
+    TEST_CASE ("Registry dispatches one argv to all plugins") {
+        Registry registry;
+        CsvPlugin csv;
+        ExcelPlugin excel;
+        CheckedCmd::Help help;
+        REQUIRE(csv.Register(registry));
+        REQUIRE(excel.Register(registry));
+        REQUIRE(registry.Register(help));
+
+        SECTION ("values end up in the descriptors of each plugin") {
+            auto args = detail::CopyToArgs({"prgname", "-l 2", "--Separator=;", "-H", "file.csv", "-o", "out"});
+            REQUIRE(registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+            CHECK(HasHeadLine(true)     == csv.has_head_line.value());
+            CHECK(CsvSep(';')           == csv.separator.value());
+            CHECK(InputFile("file.csv") == csv.input_file.value());
+            CHECK(ExcelRow(2)           == excel.row_limit.value());
+            CHECK(OutputFile("out")     == excel.output_file.value_or(OutputFile("lol")));
+            CHECK(false                 == help.value());
+        }
+        SECTION ("missing required parameter fails") {
+            auto args = detail::CopyToArgs({"prgname", "-S ,"});
+            CHECK(!registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+        }
+        SECTION ("failing check fails") {
+            auto args = detail::CopyToArgs({"prgname", "-l 0", "-S ,"});
+            CHECK(!registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+        }
+        SECTION ("unconvertible value fails") {
+            auto args = detail::CopyToArgs({"prgname", "-l x", "-S ,"});
+            CHECK(!registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+        }
+        SECTION ("unknown option fails") {
+            auto args = detail::CopyToArgs({"prgname", "-l 2", "-S ,", "--unknown"});
+            CHECK(!registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+        }
+        SECTION ("surplus positional argument fails") {
+            auto args = detail::CopyToArgs({"prgname", "-l 2", "-S ,", "file.csv", "file1.csv"});
+            CHECK(!registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+        }
+        SECTION ("tokens are split like clara does") {
+            auto args = detail::CopyToArgs({"prgname", "", "-l:2", "-S", ",", "", "file.csv"});
+            REQUIRE(registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+            CHECK(ExcelRow(2)           == excel.row_limit.value());
+            CHECK(CsvSep(',')           == csv.separator.value());
+            CHECK(InputFile("file.csv") == csv.input_file.value());
+        }
+        SECTION ("bundled short flags") {
+            auto args = detail::CopyToArgs({"prgname", "-l 2", "-S ,", "-Hh"});
+            REQUIRE(registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+            CHECK(HasHeadLine(true) == csv.has_head_line.value());
+            CHECK(help.value());
+        }
+        SECTION ("option instead of a value fails") {
+            auto args = detail::CopyToArgs({"prgname", "-S ,", "-l", "-H"});
+            CHECK(!registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+        }
+        SECTION ("values of a previous parse do not remain") {
+            auto first = detail::CopyToArgs({"prgname", "-l 2", "-S ,", "-H", "-o", "x", "file.csv", "-h"});
+            REQUIRE(registry.Parse(static_cast<int>(first.size()), detail::IntoPtrs(first)));
+            REQUIRE(help.value());
+
+            auto second = detail::CopyToArgs({"prgname", "-l 3", "-S ;"});
+            REQUIRE(registry.Parse(static_cast<int>(second.size()), detail::IntoPtrs(second)));
+            CHECK(HasHeadLine(false)    == csv.has_head_line.value());
+            CHECK(!excel.output_file.has_value());
+            CHECK(InputFile("")         == csv.input_file.value());
+            CHECK(ExcelRow(3)           == excel.row_limit.value());
+            CHECK(!help.value());
+            CHECK(help.GetDescription().Get().empty());
+        }
+        SECTION ("help alone skips required parameters and checks") {
+            auto args = detail::CopyToArgs({"prgname", "-h"});
+            REQUIRE(registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+            CHECK(help.value());
+            CHECK(help.GetDescription().Get().find("-S, --Separator") != std::string::npos);
+        }
+        SECTION ("help lists the options of all plugins") {
+            auto args = detail::CopyToArgs({"prgname", "-l 2", "-S ,", "-h"});
+            REQUIRE(registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+            CHECK(help.value());
+            CHECK(help.GetDescription().Get().find("-H, --HasHeadLine") != std::string::npos);
+            CHECK(help.GetDescription().Get().find("-l, --LineLimit <1..65535>") != std::string::npos);
+        }
+    }
+
+    TEST_CASE ("Registry rejects conflicting names") {
+        Registry registry;
+        CsvPlugin csv;
+        REQUIRE(csv.Register(registry));
+
+        SECTION ("duplicate short name") {
+            CmdHasHeadLine other(ShortName("-H"), LongName("--Other"), Description("lol"));
+            CHECK(!registry.Register(other));
+            CHECK(3 == registry.size());
+        }
+        SECTION ("duplicate long name") {
+            CmdHasHeadLine other(ShortName("-X"), LongName("--Separator"), Description("lol"));
+            CHECK(!registry.Register(other));
+            CHECK(3 == registry.size());
+        }
+        SECTION ("name without leading dash") {
+            CmdHasHeadLine other(ShortName("X"), LongName("--Other"), Description("lol"));
+            CHECK(!registry.Register(other));
+            CHECK(3 == registry.size());
+        }
+        SECTION ("names the tokenizer can not produce") {
+            for (auto const name : {"--a=b", "--a:b", "--a b", "--"}) {
+                CmdHasHeadLine other(ShortName(""), LongName(name), Description("lol"));
+                CHECK(!registry.Register(other));
+            }
+            CHECK(3 == registry.size());
+        }
+        SECTION ("second help") {
+            CheckedCmd::Help help;
+            CheckedCmd::Help other_help;
+            CHECK(registry.Register(help));
+            CHECK(!registry.Register(other_help));
+            CHECK(4 == registry.size());
+        }
+    }
+
+    TEST_CASE ("Registry converts bool values like clara") {
+        CheckedCmd::Param<bool> strict(Hint("bool"), ShortName("-x"), LongName("--strict"), Description("lol"), NoChecks);
+        Registry registry;
+        REQUIRE(registry.Register(strict));
+
+        for (auto const word : {"y", "1", "true", "YES", "On"}) {
+            auto args = detail::CopyToArgs({"prgname", "-x", word});
+            REQUIRE(registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+            CHECK(strict.value());
+        }
+        for (auto const word : {"n", "0", "False", "no", "OFF"}) {
+            auto args = detail::CopyToArgs({"prgname", "-x", word});
+            REQUIRE(registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+            CHECK(!strict.value());
+        }
+        auto args = detail::CopyToArgs({"prgname", "-x", "maybe"});
+        CHECK(!registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+    }
+
+    TEST_CASE ("Registry scales to many options") {
+        Registry registry;
+        std::deque<CheckedCmd::Param<std::optional<ExcelRow>>> params;
+        for (int i = 0; i < 5000; ++i) {
+            auto const name = std::to_string(i);
+            params.emplace_back(Hint(""), ShortName(""), LongName("--opt" + name), Description(""), NoChecks);
+            REQUIRE(registry.Register(params.back()));
+        }
+
+        auto args = detail::CopyToArgs({"prgname", "--opt0=1", "--opt2500=2", "--opt4999=3"});
+        REQUIRE(registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+        CHECK(ExcelRow(1) == params[0].value());
+        CHECK(ExcelRow(2) == params[2500].value());
+        CHECK(ExcelRow(3) == params[4999].value());
+        CHECK(!params[1].has_value());
+    }
+}
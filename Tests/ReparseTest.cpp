@@ -0,0 +1,108 @@
+#include <catch.hpp>
+#include <checked_cmd.h>
+#include "TestArgs.h"
+#include <cstdint>
+
+namespace ReparseTest {
+    namespace detail = TestArgs;
+
+    using namespace CheckedCmd;
+
+    using HasHeadLine = CheckedCmdTypesafe::Typesafe<bool,        struct TypeTagHasHeadLine>;
+    using InputFile   = CheckedCmdTypesafe::Typesafe<std::string, struct TypeTagInputFile>;
+    using OutputFile  = CheckedCmdTypesafe::Typesafe<std::string, struct TypeTagOutputFile>;
+    using ExcelRow    = CheckedCmdTypesafe::Typesafe<uint16_t,    struct TypeTagExcelRow>;
+
+    using CmdHasHeadLine   = CheckedCmd::Flag<HasHeadLine>;
+    using CmdInputFile     = CheckedCmd::Arg<InputFile>;
+    using CmdOutputFile    = CheckedCmd::Param<std::optional<OutputFile>>;
+    using CmdExcelRowLimit = CheckedCmd::Param<ExcelRow>;
+
+    int input_file_checks = 0;
+    int row_limit_checks  = 0;
+
+    bool InputFileValidator(InputFile const &inputFile) {
+        ++input_file_checks;
+        return inputFile.Get().size() < 100;
+    }
+
+    bool RowLimitValidator(ExcelRow const &excelRow) {
+        ++row_limit_checks;
+        return (excelRow.Get() > 0);
+    }
+
+    auto const NoChecks = [](auto const &) { return true; };
+
+    TEST_CASE ("ReparseCmdArgsTuple") {
+        auto const config = std::make_tuple(CmdHasHeadLine(ShortName("-H"), LongName("--HasHeadLine"), Description("lol")),
+                                            CmdInputFile(Hint("inputfile"), Description("lol"), InputFileValidator),
+                                            CmdOutputFile(Hint("filename"), ShortName("-o"), LongName("--OutPutFile"),
+                                                          Description("lol"), NoChecks),
+                                            CmdExcelRowLimit(Hint("1..65535"), ShortName("-l"), LongName("--LineLimit"),
+                                                             Description("lol"), RowLimitValidator)
+        );
+        auto args = detail::CopyToArgs({"prgname", "-l 2", "file.csv"});
+        auto const previous = ParseCmdArgsTuple(static_cast<int>(args.size()), detail::IntoPtrs(args), config);
+        REQUIRE(previous.has_value());
+
+        input_file_checks = 0;
+        row_limit_checks  = 0;
+
+        SECTION ("unchanged arguments call no checks") {
+            auto new_args = detail::CopyToArgs({"prgname", "file.csv", "-l 2"});
+            auto const reparsed = ReparseCmdArgsTuple(static_cast<int>(new_args.size()), detail::IntoPtrs(new_args), previous.value());
+            REQUIRE(reparsed.has_value());
+            CHECK(reparsed->changed.none());
+            CHECK(0 == input_file_checks);
+            CHECK(0 == row_limit_checks);
+        }
+        SECTION ("only changed options are checked and reported") {
+            auto new_args = detail::CopyToArgs({"prgname", "-l 3", "-H", "file.csv"});
+            auto const reparsed = ReparseCmdArgsTuple(static_cast<int>(new_args.size()), detail::IntoPtrs(new_args), previous.value());
+            REQUIRE(reparsed.has_value());
+            CHECK(reparsed->HasChanged<CmdExcelRowLimit>());
+            CHECK(reparsed->HasChanged<CmdHasHeadLine>());
+            CHECK(!reparsed->HasChanged<CmdInputFile>());
+            CHECK(!reparsed->HasChanged<CmdOutputFile>());
+            CHECK(0 == input_file_checks);
+            CHECK(1 == row_limit_checks);
+            CHECK(ExcelRow(3) == std::get<CmdExcelRowLimit>(reparsed->args).value());
+            CHECK(InputFile("file.csv") == std::get<CmdInputFile>(reparsed->args).value());
+        }
+        SECTION ("removed optional parameter counts as changed") {
+            auto with_output = detail::CopyToArgs({"prgname", "-l 2", "-o out", "file.csv"});
+            auto const first = ReparseCmdArgsTuple(static_cast<int>(with_output.size()), detail::IntoPtrs(with_output), previous.value());
+            REQUIRE(first.has_value());
+            CHECK(first->HasChanged<CmdOutputFile>());
+
+            auto without_output = detail::CopyToArgs({"prgname", "-l 2", "file.csv"});
+            auto const second = ReparseCmdArgsTuple(static_cast<int>(without_output.size()), detail::IntoPtrs(without_output), first->args);
+            REQUIRE(second.has_value());
+            CHECK(second->HasChanged<CmdOutputFile>());
+            CHECK(!std::get<CmdOutputFile>(second->args).has_value());
+        }
+        SECTION ("options missing from the new argv get their defaults") {
+            auto with_flag = detail::CopyToArgs({"prgname", "-l 2", "-H", "file.csv"});
+            auto const first = ReparseCmdArgsTuple(static_cast<int>(with_flag.size()), detail::IntoPtrs(with_flag), previous.value());
+            REQUIRE(first.has_value());
+            REQUIRE(HasHeadLine(true) == std::get<CmdHasHeadLine>(first->args).value());
+
+            auto without_flag = detail::CopyToArgs({"prgname", "-l 2", "file.csv"});
+            auto const second = ReparseCmdArgsTuple(static_cast<int>(without_flag.size()), detail::IntoPtrs(without_flag), first->args);
+            REQUIRE(second.has_value());
+            CHECK(HasHeadLine(false) == std::get<CmdHasHeadLine>(second->args).value());
+            CHECK(second->HasChanged<CmdHasHeadLine>());
+            CHECK(!second->HasChanged<CmdExcelRowLimit>());
+        }
+        SECTION ("failing check of a changed option fails") {
+            auto new_args = detail::CopyToArgs({"prgname", "-l 0", "file.csv"});
+            auto const reparsed = ReparseCmdArgsTuple(static_cast<int>(new_args.size()), detail::IntoPtrs(new_args), previous.value());
+            CHECK(!reparsed.has_value());
+        }
+        SECTION ("parse error fails") {
+            auto new_args = detail::CopyToArgs({"prgname", "-l 2", "file.csv", "--unknown"});
+            auto const reparsed = ReparseCmdArgsTuple(static_cast<int>(new_args.size()), detail::IntoPtrs(new_args), previous.value());
+            CHECK(!reparsed.has_value());
+        }
+    }
+}
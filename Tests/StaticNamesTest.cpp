@@ -0,0 +1,115 @@
+#include <catch.hpp>
+#include <checked_cmd.h>
+#include "TestArgs.h"
+#include <cstdint>
+
+namespace StaticNamesTest {
+    namespace detail = TestArgs;
+
+    using namespace CheckedCmd;
+
+    struct TypeTagHasHeadLine{
+        static constexpr std::string_view short_name = "-H";
+        static constexpr std::string_view long_name  = "--HasHeadLine";
+    };
+    struct TypeTagExcelRow{
+        static constexpr std::string_view short_name = "-l";
+        static constexpr std::string_view long_name  = "--LineLimit";
+    };
+    struct TypeTagCsvSep{
+        static constexpr std::string_view short_name = "-S";
+        static constexpr std::string_view long_name  = "--Separator";
+    };
+    struct TypeTagDuplicate{
+        static constexpr std::string_view short_name = "-H";
+        static constexpr std::string_view long_name  = "--Duplicate";
+    };
+    struct TypeTagVerbose{
+        static constexpr std::string_view short_name = "";
+        static constexpr std::string_view long_name  = "--Verbose";
+    };
+    struct TypeTagUnnamed{
+        static constexpr std::string_view short_name = "";
+        static constexpr std::string_view long_name  = "";
+    };
+    struct TypeTagMalformed{
+        static constexpr std::string_view short_name = "m";
+        static constexpr std::string_view long_name  = "--Malformed";
+    };
+    struct TypeTagEndOfOptions{
+        static constexpr std::string_view short_name = "-e";
+        static constexpr std::string_view long_name  = "--";
+    };
+    struct TypeTagWithValue{
+        static constexpr std::string_view short_name = "-w";
+        static constexpr std::string_view long_name  = "--With=Value";
+    };
+
+    using HasHeadLine = CheckedCmdTypesafe::Typesafe<bool,        TypeTagHasHeadLine>;
+    using ExcelRow    = CheckedCmdTypesafe::Typesafe<uint16_t,    TypeTagExcelRow>;
+    using CsvSep      = CheckedCmdTypesafe::Typesafe<char,        TypeTagCsvSep>;
+    using Duplicate   = CheckedCmdTypesafe::Typesafe<bool,        TypeTagDuplicate>;
+    using Verbose     = CheckedCmdTypesafe::Typesafe<bool,        TypeTagVerbose>;
+    using EndOfOpts   = CheckedCmdTypesafe::Typesafe<std::string, TypeTagEndOfOptions>;
+    using WithValue   = CheckedCmdTypesafe::Typesafe<std::string, TypeTagWithValue>;
+    using Malformed   = CheckedCmdTypesafe::Typesafe<std::string, TypeTagMalformed>;
+    using Unnamed     = CheckedCmdTypesafe::Typesafe<std::string, TypeTagUnnamed>;
+    using InputFile   = CheckedCmdTypesafe::Typesafe<std::string, struct TypeTagInputFile>;
+
+    using CmdHasHeadLine   = CheckedCmd::Flag<HasHeadLine>;
+    using CmdExcelRowLimit = CheckedCmd::Param<std::optional<ExcelRow>>;
+    using CmdCsvSep        = CheckedCmd::Param<CsvSep>;
+    using CmdDuplicate     = CheckedCmd::Flag<Duplicate>;
+    using CmdVerbose       = CheckedCmd::Flag<Verbose>;
+    using CmdEndOfOpts     = CheckedCmd::Param<EndOfOpts>;
+    using CmdWithValue     = CheckedCmd::Param<std::optional<WithValue>>;
+    using CmdMalformed     = CheckedCmd::Param<Malformed>;
+    using CmdUnnamed       = CheckedCmd::Param<Unnamed>;
+    using CmdInputFile     = CheckedCmd::Arg<InputFile>;
+    using CmdNamedArg      = CheckedCmd::Arg<ExcelRow>;
+
+    using Valid = std::tuple<CmdHasHeadLine, CmdExcelRowLimit, CmdCsvSep, CmdVerbose, CmdInputFile, CheckedCmd::Help>;
+    static_assert(StaticNames<Valid>::AreWellFormed());
+    static_assert(StaticNames<Valid>::AreDistinct());
+    static_assert(StaticNames<Valid>::ArgsAreUnnamed());
+
+    static_assert(!StaticNames<std::tuple<CmdHasHeadLine, CmdDuplicate>>::AreDistinct());
+    static_assert(!StaticNames<std::tuple<CheckedCmd::Help, CheckedCmd::Help>>::AreDistinct());
+    static_assert(!StaticNames<std::tuple<CmdHasHeadLine, CmdMalformed>>::AreWellFormed());
+    static_assert(!StaticNames<std::tuple<CmdHasHeadLine, CmdUnnamed>>::AreWellFormed());
+    static_assert(!StaticNames<std::tuple<CmdHasHeadLine, CmdEndOfOpts>>::AreWellFormed());
+    static_assert(!StaticNames<std::tuple<CmdHasHeadLine, CmdWithValue>>::AreWellFormed());
+    static_assert(!StaticNames<std::tuple<CmdHasHeadLine, CmdNamedArg>>::ArgsAreUnnamed());
+    static_assert(!std::is_constructible_v<CmdHasHeadLine, ShortName, LongName, Description>);
+    static_assert(!std::is_constructible_v<CmdCsvSep, Hint, ShortName, LongName, Description, std::function<bool(char)>>);
+    static_assert(!std::is_constructible_v<CmdExcelRowLimit, Hint, ShortName, LongName, Description, std::function<bool(ExcelRow)>>);
+    static_assert(std::is_constructible_v<CmdInputFile, Hint, Description, std::function<bool(InputFile)>>);
+    static_assert(2 == count_of<CheckedCmd::Help, std::tuple<CheckedCmd::Help, CmdHasHeadLine, CheckedCmd::Help>>::value);
+
+    auto const NoChecks = [](auto const &) { return true; };
+
+    TEST_CASE ("names from the TypeTag") {
+        auto const config = std::make_tuple(CmdHasHeadLine(Description("lol")),
+                                            CmdExcelRowLimit(Hint("1..65535"), Description("lol"), NoChecks),
+                                            CmdCsvSep(Hint(""), Description("lol"), NoChecks),
+                                            CmdVerbose(Description("lol")),
+                                            CmdInputFile(Hint("inputfile"), Description("lol"), NoChecks),
+                                            CheckedCmd::Help()
+        );
+
+        CHECK(ShortName("-l")          == std::get<CmdExcelRowLimit>(config).GetShortName());
+        CHECK(LongName("--LineLimit")  == std::get<CmdExcelRowLimit>(config).GetName());
+        CHECK(ShortName("-S")          == std::get<CmdCsvSep>(config).GetShortName());
+        CHECK(ShortName("-h")          == std::get<CheckedCmd::Help>(config).GetShortName());
+        CHECK(ShortName("")            == std::get<CmdVerbose>(config).GetShortName());
+
+        auto args = detail::CopyToArgs({"prgname", "-H", "--LineLimit=7", "--Separator=;", "--Verbose", "file.csv"});
+        auto const success = ParseCmdArgsTuple(static_cast<int>(args.size()), detail::IntoPtrs(args), config);
+        REQUIRE(success.has_value());
+        CHECK(HasHeadLine(true)     == std::get<CmdHasHeadLine>(success.value()).value());
+        CHECK(ExcelRow(7)           == std::get<CmdExcelRowLimit>(success.value()).value());
+        CHECK(CsvSep(';')           == std::get<CmdCsvSep>(success.value()).value());
+        CHECK(Verbose(true)         == std::get<CmdVerbose>(success.value()).value());
+        CHECK(InputFile("file.csv") == std::get<CmdInputFile>(success.value()).value());
+    }
+}
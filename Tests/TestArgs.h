@@ -0,0 +1,26 @@
+#ifndef CHECKED_CMD_TEST_ARGS_H
+#define CHECKED_CMD_TEST_ARGS_H
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace TestArgs {
+    inline auto CopyToArgs(std::initializer_list<std::string> const& list){
+        std::vector<std::unique_ptr<char[]>> result;
+        for (auto const &item: list){
+            result.push_back(std::make_unique<char[]>(item.size()+1));
+            std::strncpy(result.back().get(), item.c_str(), item.size()+1);
+        }
+        return result;
+    }
+    inline auto IntoPtrs(std::vector<std::unique_ptr<char[]>> & args){
+        auto result = new char*[args.size()];
+        std::transform(std::begin(args), std::end(args), result, [](auto & uptr){ return uptr.get();});
+        return result;
+    }
+}
+
+#endif //CHECKED_CMD_TEST_ARGS_H
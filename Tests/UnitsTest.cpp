@@ -0,0 +1,100 @@
+#include <catch.hpp>
+#include <checked_cmd.h>
+#include <checked_cmd_registry.h>
+#include "TestArgs.h"
+#include <sstream>
+
+namespace UnitsTest {
+    namespace detail = TestArgs;
+
+    using namespace CheckedCmd;
+    using namespace std::chrono_literals;
+
+    using CacheSize = CheckedCmdTypesafe::Typesafe<Bytes,    struct TypeTagCacheSize>;
+    using Timeout   = CheckedCmdTypesafe::Typesafe<Duration, struct TypeTagTimeout>;
+
+    using CmdCacheSize = CheckedCmd::Param<CacheSize>;
+    using CmdTimeout   = CheckedCmd::Param<std::optional<Timeout>>;
+
+    auto const NoChecks = [](auto const &) { return true; };
+
+    template<typename T>
+    std::string Print(T const& value) {
+        std::ostringstream os;
+        os << value;
+        return os.str();
+    }
+
+    TEST_CASE ("Bytes") {
+        CHECK(Bytes(512u << 20)           == Bytes::FromString("512MiB"));
+        CHECK(Bytes(4000)                 == Bytes::FromString("4kB"));
+        CHECK(Bytes(100)                  == Bytes::FromString("100"));
+        CHECK(Bytes(100)                  == Bytes::FromString("100B"));
+        CHECK(!Bytes::FromString("4kiB").has_value());
+        CHECK(!Bytes::FromString("MiB").has_value());
+        CHECK(!Bytes::FromString("-1B").has_value());
+        CHECK(!Bytes::FromString("16EiB").has_value());
+        CHECK(!Bytes::FromString("99999999999999999999").has_value());
+
+        CHECK("512MiB" == Print(Bytes(512u << 20)));
+        CHECK("4kB"    == Print(Bytes(4000)));
+        CHECK("0B"     == Print(Bytes(0)));
+        CHECK("1001B"  == Print(Bytes(1001)));
+    }
+
+    TEST_CASE ("Duration") {
+        CHECK(Duration(250ms)   == Duration::FromString("250ms"));
+        CHECK(Duration(2h)      == Duration::FromString("2h"));
+        CHECK(Duration(90s)     == Duration::FromString("90s"));
+        CHECK(Duration(5min)    == Duration::FromString("5min"));
+        CHECK(Duration(7us)     == Duration::FromString("7us"));
+        CHECK(Duration(1ns)     == Duration::FromString("1ns"));
+        CHECK(!Duration::FromString("250").has_value());
+        CHECK(!Duration::FromString("1d").has_value());
+        CHECK(!Duration::FromString("3000000h").has_value());
+
+        CHECK(250 == Duration(250ms).As<std::chrono::milliseconds>().count());
+        CHECK("90s"  == Print(Duration(90s)));
+        CHECK("2h"   == Print(Duration(120min)));
+        CHECK("0ns"  == Print(Duration()));
+        CHECK("-5s"  == Print(Duration(-5s)));
+        CHECK("-90min" == Print(Duration(-90min)));
+        CHECK("-9223372036854775808ns" == Print(Duration(std::chrono::nanoseconds::min())));
+    }
+
+    TEST_CASE ("Param<Typesafe<Bytes>> and Param<std::optional<Typesafe<Duration>>>") {
+        auto const config = std::make_tuple(CmdCacheSize(Hint("size"), ShortName("-c"), LongName("--cache"),
+                                                         Description("lol"), NoChecks),
+                                            CmdTimeout(Hint("duration"), ShortName("-t"), LongName("--timeout"),
+                                                       Description("lol"),
+                                                       [](Timeout const& timeout) { return timeout.Get().Get() < 1h; })
+        );
+
+        SECTION ("ParseCmdArgsTuple") {
+            auto args = detail::CopyToArgs({"prgname", "--cache", "512MiB", "-t 250ms"});
+            auto const success = ParseCmdArgsTuple(static_cast<int>(args.size()), detail::IntoPtrs(args), config);
+            REQUIRE(success.has_value());
+            CHECK(std::size_t{512} << 20 == std::get<CmdCacheSize>(success.value()).value().Get().Get());
+            CHECK(Duration(250ms) == std::get<CmdTimeout>(success.value()).value().Get());
+        }
+        SECTION ("failing check") {
+            auto args = detail::CopyToArgs({"prgname", "--cache", "512MiB", "-t 2h"});
+            CHECK(!ParseCmdArgsTuple(static_cast<int>(args.size()), detail::IntoPtrs(args), config).has_value());
+        }
+        SECTION ("unknown unit") {
+            auto args = detail::CopyToArgs({"prgname", "--cache", "512Mb"});
+            CHECK(!ParseCmdArgsTuple(static_cast<int>(args.size()), detail::IntoPtrs(args), config).has_value());
+        }
+        SECTION ("Registry") {
+            auto cache   = std::get<CmdCacheSize>(config);
+            auto timeout = std::get<CmdTimeout>(config);
+            Registry registry;
+            REQUIRE(registry.Register(cache));
+            REQUIRE(registry.Register(timeout));
+            auto args = detail::CopyToArgs({"prgname", "--cache=1GiB", "--timeout=5min"});
+            REQUIRE(registry.Parse(static_cast<int>(args.size()), detail::IntoPtrs(args)));
+            CHECK(CacheSize(Bytes(1u << 30)) == cache.value());
+            CHECK(Timeout(Duration(5min))    == timeout.value());
+        }
+    }
+}
@@ -5,14 +5,21 @@
 #ifndef CHECKED_CMD_H
 #define CHECKED_CMD_H
 #include <utility>
+#include <array>
+#include <bitset>
+#include <charconv>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <tuple>
 #include <optional>
 #include <vector>
 #include <clara.hpp>
 #include <functional>
 #include <regex>
+#include <string_view>
 
 namespace CheckedCmd{
     namespace CheckedCmdTypesafe{
@@ -67,10 +74,177 @@ namespace CheckedCmd{
         constexpr auto reverse(Tuple t) {
             return detail::index_apply<std::tuple_size<Tuple>{}>(
                 [&](auto... Is) {
-                    return make_tuple(
+                    return std::make_tuple(
                         std::get<std::tuple_size<Tuple>{} - 1 - Is>(t)...);
                 });
         }
+
+        constexpr char ToLower(char c){
+            return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+        }
+
+        constexpr std::uint64_t Fnv1a(std::string_view str, bool ignore_case = false){
+            std::uint64_t hash = 14695981039346656037ull;
+            for (auto c : str){
+                hash ^= static_cast<unsigned char>(ignore_case ? ToLower(c) : c);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        //splitmix64 finalizer
+        constexpr std::uint64_t Mix(std::uint64_t x){
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ull;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebull;
+            x ^= x >> 31;
+            return x;
+        }
+
+        constexpr bool Equals(std::string_view lhs, std::string_view rhs, bool ignore_case){
+            if (lhs.size() != rhs.size()) return false;
+            for (std::size_t i = 0; i < lhs.size(); ++i){
+                if ((ignore_case ? ToLower(lhs[i]) : lhs[i]) != (ignore_case ? ToLower(rhs[i]) : rhs[i]))
+                    return false;
+            }
+            return true;
+        }
+
+        // A name clara can match: it starts with '-', is not "--" which ends the options,
+        // and contains none of ' ', ':' and '=' which separate a name from its value.
+        constexpr bool IsOptionName(std::string_view name){
+            return name.size() > 1 && name[0] == '-' && name != "--" && name.find_first_of(" :=") == std::string_view::npos;
+        }
+
+        constexpr std::size_t NextPowerOfTwo(std::size_t n){
+            std::size_t result = 1;
+            while (result < n) result *= 2;
+            return result;
+        }
+
+        enum class PerfectHashStatus{Valid, DuplicateName, NoDisplacement};
+
+        // Minimal perfect hash (hash and displace) over a fixed list of N names, built at compile time.
+        // A name is hashed once, its bucket selects a displacement which mixed into the hash gives the slot.
+        // Building it takes linear work in N, so it stays within the constexpr limits for long lists.
+        template<std::size_t N>
+        class PerfectHash{
+        public:
+            static constexpr std::size_t empty = N;
+
+            template<typename Names>
+            constexpr PerfectHash(Names const& names, bool ignore_case_)
+                :ignore_case(ignore_case_){
+                for (auto& slot : slots) slot = empty;
+                status = Build(names);
+            }
+
+            constexpr auto GetStatus()const -> PerfectHashStatus{
+                return status;
+            }
+
+            template<typename Names>
+            constexpr auto Find(Names const& names, std::string_view name)const -> std::size_t{
+                auto const hash  = Fnv1a(name, ignore_case);
+                auto const index = slots[Slot(hash, displacement[Bucket(hash)])];
+                return (index != empty && Equals(names[index], name, ignore_case)) ? index : empty;
+            }
+        private:
+            static constexpr std::size_t slot_count   = NextPowerOfTwo(2 * N);
+            static constexpr std::size_t bucket_count = NextPowerOfTwo(N / 2 + 1);
+            static constexpr std::uint64_t max_displacement = 1u << 12;
+
+            // The names grouped by bucket: members[offsets[b]] ... members[offsets[b + 1] - 1] are in bucket b.
+            struct Buckets{
+                std::array<std::uint64_t, N> hashes{};
+                std::array<std::size_t, N> members{};
+                std::array<std::size_t, bucket_count + 1> offsets{};
+            };
+
+            static constexpr std::size_t Bucket(std::uint64_t hash){
+                return static_cast<std::size_t>(hash) & (bucket_count - 1);
+            }
+
+            static constexpr std::size_t Slot(std::uint64_t hash, std::uint64_t displacement_){
+                return static_cast<std::size_t>(Mix(hash + displacement_ * 0x9e3779b97f4a7c15ull)) & (slot_count - 1);
+            }
+
+            template<typename Names>
+            constexpr auto Build(Names const& names) -> PerfectHashStatus{
+                Buckets buckets{};
+                for (std::size_t i = 0; i < N; ++i){
+                    buckets.hashes[i] = Fnv1a(names[i], ignore_case);
+                    ++buckets.offsets[Bucket(buckets.hashes[i]) + 1];
+                }
+                for (std::size_t bucket = 0; bucket < bucket_count; ++bucket){
+                    buckets.offsets[bucket + 1] += buckets.offsets[bucket];
+                }
+                std::array<std::size_t, bucket_count> filled{};
+                for (std::size_t i = 0; i < N; ++i){
+                    auto const bucket = Bucket(buckets.hashes[i]);
+                    buckets.members[buckets.offsets[bucket] + filled[bucket]++] = i;
+                }
+
+                // equal names have equal hashes, so only those need to be compared
+                for (std::size_t bucket = 0; bucket < bucket_count; ++bucket){
+                    for (auto i = buckets.offsets[bucket]; i < buckets.offsets[bucket + 1]; ++i){
+                        for (auto j = buckets.offsets[bucket]; j < i; ++j){
+                            auto const lhs = buckets.members[i];
+                            auto const rhs = buckets.members[j];
+                            if (buckets.hashes[lhs] == buckets.hashes[rhs] && Equals(names[lhs], names[rhs], ignore_case))
+                                return PerfectHashStatus::DuplicateName;
+                        }
+                    }
+                }
+
+                // fill the largest buckets first, while most slots are still free
+                std::array<std::size_t, N + 1> size_counts{};
+                for (std::size_t bucket = 0; bucket < bucket_count; ++bucket){
+                    ++size_counts[buckets.offsets[bucket + 1] - buckets.offsets[bucket]];
+                }
+                for (std::size_t size = N; size > 0; --size){
+                    size_counts[size - 1] += size_counts[size];
+                }
+                std::array<std::size_t, bucket_count> by_size{};
+                for (std::size_t bucket = 0; bucket < bucket_count; ++bucket){
+                    auto const size = buckets.offsets[bucket + 1] - buckets.offsets[bucket];
+                    by_size[--size_counts[size]] = bucket;
+                }
+                for (auto const bucket : by_size){
+                    if (buckets.offsets[bucket] == buckets.offsets[bucket + 1]) break;
+                    if (!Place(buckets, bucket)) return PerfectHashStatus::NoDisplacement;
+                }
+                return PerfectHashStatus::Valid;
+            }
+
+            constexpr bool Place(Buckets const& buckets, std::size_t bucket){
+                auto const first = buckets.offsets[bucket];
+                auto const last  = buckets.offsets[bucket + 1];
+                for (std::uint64_t candidate = 0; candidate < max_displacement; ++candidate){
+                    auto placed = first;
+                    for (; placed < last; ++placed){
+                        auto const member = buckets.members[placed];
+                        auto& slot = slots[Slot(buckets.hashes[member], candidate)];
+                        if (slot != empty) break;
+                        slot = member;
+                    }
+                    if (placed == last){
+                        displacement[bucket] = candidate;
+                        return true;
+                    }
+                    for (auto i = first; i < placed; ++i){
+                        slots[Slot(buckets.hashes[buckets.members[i]], candidate)] = empty;
+                    }
+                }
+                return false;
+            }
+
+            bool ignore_case = false;
+            PerfectHashStatus status = PerfectHashStatus::Valid;
+            std::array<std::uint64_t, bucket_count> displacement{};
+            std::array<std::size_t, slot_count> slots{};
+        };
     }
 
     using Description = CheckedCmdTypesafe::Typesafe<std::string, struct TypeTagDescription>;
@@ -79,6 +253,265 @@ namespace CheckedCmd{
     using Hint        = CheckedCmdTypesafe::Typesafe<std::string, struct TypeTagHint>;
     using HelpFlag    = CheckedCmdTypesafe::Typesafe<bool,        struct TypeTagHelpFlag>;
 
+    // Option names can be given at compile time by the TypeTag of a Typesafe:
+    //     struct TypeTagExcelRow{
+    //         static constexpr std::string_view short_name = "-l";
+    //         static constexpr std::string_view long_name  = "--LineLimit";
+    //     };
+    // Descriptors then can be constructed without ShortName and LongName, and ParseCmd rejects
+    // duplicate and malformed names with a static_assert.
+    struct TypeTagHelpFlag{
+        static constexpr std::string_view short_name = "-h";
+        static constexpr std::string_view long_name  = "--help";
+    };
+
+    template<typename TypeTag, typename = void>
+    struct has_static_names : std::false_type {};
+
+    template<typename TypeTag>
+    struct has_static_names<TypeTag, std::void_t<decltype(TypeTag::short_name), decltype(TypeTag::long_name)>> : std::true_type {};
+
+    template<typename T>
+    struct TagOf{
+        using type = void;
+    };
+
+    template<typename T, typename TypeTag>
+    struct TagOf<CheckedCmdTypesafe::Typesafe<T, TypeTag>>{
+        using type = TypeTag;
+    };
+
+    template<typename T>
+    struct TagOf<std::optional<T>>: TagOf<T>{};
+
+    template<typename TypeTag>
+    auto StaticShortName(){
+        static_assert(has_static_names<TypeTag>::value, "the TypeTag has to provide short_name and long_name");
+        return ShortName(std::string(TypeTag::short_name));
+    }
+
+    template<typename TypeTag>
+    auto StaticLongName(){
+        static_assert(has_static_names<TypeTag>::value, "the TypeTag has to provide short_name and long_name");
+        return LongName(std::string(TypeTag::long_name));
+    }
+
+    enum class EnumCase{Sensitive, Insensitive};
+
+    // Names::names lists the names of the enumerators of E, the position of a name is its underlying value.
+    // The names are mapped back by a perfect hash table which is built at compile time.
+    template<typename E, typename Names, EnumCase Case = EnumCase::Sensitive>
+    class Enum{
+        E value{};
+    public:
+        using type = E;
+        static constexpr std::size_t count = std::size(Names::names);
+
+        Enum()=default;
+        constexpr explicit Enum(E e):value(e){}
+        constexpr E Get()const{return value;}
+        constexpr bool operator==(Enum const& other)const{
+            return value == other.value;
+        }
+
+        static constexpr auto FromString(std::string_view name) -> std::optional<Enum>{
+            auto const index = table.Find(Names::names, name);
+            if (index == count) return std::nullopt;
+            return Enum(static_cast<E>(index));
+        }
+
+        constexpr auto ToString()const -> std::string_view{
+            return Names::names[static_cast<std::size_t>(value)];
+        }
+
+        static auto Choices() -> std::string{
+            std::string choices;
+            for (std::string_view name : Names::names){
+                if (!choices.empty()) choices += '|';
+                choices += name;
+            }
+            return choices;
+        }
+    private:
+        static constexpr Helpers::PerfectHash<count> table{Names::names, Case == EnumCase::Insensitive};
+        static_assert(table.GetStatus() != Helpers::PerfectHashStatus::DuplicateName, "Enum names must be distinct");
+        static_assert(table.GetStatus() != Helpers::PerfectHashStatus::NoDisplacement, "no perfect hash found for the Enum names");
+    };
+
+    template<typename E, typename Names, EnumCase Case>
+    std::istream& operator>>(std::istream& is, Enum<E, Names, Case>& target){
+        std::string name;
+        if (is >> name){
+            if (auto const parsed = Enum<E, Names, Case>::FromString(name)) target = parsed.value();
+            else is.setstate(std::ios_base::failbit);
+        }
+        return is;
+    }
+
+    template<typename E, typename Names, EnumCase Case>
+    std::ostream& operator<<(std::ostream& os, Enum<E, Names, Case> const& target){
+        os << target.ToString();
+        return os;
+    }
+
+    namespace Helpers{
+        struct Unit{
+            std::string_view suffix;
+            std::uint64_t factor;
+        };
+
+        // The first entry is the base unit, it is used for printing zero.
+        inline constexpr std::array<Unit, 14> byte_units{{
+            {"B",   1ull},
+            {"",    1ull},
+            {"kB",  1000ull},
+            {"MB",  1000ull * 1000},
+            {"GB",  1000ull * 1000 * 1000},
+            {"TB",  1000ull * 1000 * 1000 * 1000},
+            {"PB",  1000ull * 1000 * 1000 * 1000 * 1000},
+            {"EB",  1000ull * 1000 * 1000 * 1000 * 1000 * 1000},
+            {"KiB", 1ull << 10},
+            {"MiB", 1ull << 20},
+            {"GiB", 1ull << 30},
+            {"TiB", 1ull << 40},
+            {"PiB", 1ull << 50},
+            {"EiB", 1ull << 60}
+        }};
+
+        inline constexpr std::array<Unit, 6> duration_units{{
+            {"ns",  1ull},
+            {"us",  1000ull},
+            {"ms",  1000ull * 1000},
+            {"s",   1000ull * 1000 * 1000},
+            {"min", 1000ull * 1000 * 1000 * 60},
+            {"h",   1000ull * 1000 * 1000 * 60 * 60}
+        }};
+
+        // Parses a non negative integer directly followed by one of the suffixes in units, e.g. "512MiB".
+        // Fails if the suffix is unknown or the result exceeds max.
+        template<std::size_t N>
+        auto ParseWithUnit(std::string_view text, std::array<Unit, N> const& units, std::uint64_t max) -> std::optional<std::uint64_t>{
+            auto const first = text.data();
+            auto const last  = text.data() + text.size();
+            std::uint64_t number = 0;
+            auto const [end, error] = std::from_chars(first, last, number);
+            if (error != std::errc()) return std::nullopt;
+
+            auto const suffix = std::string_view(end, static_cast<std::size_t>(last - end));
+            for (auto const& unit : units){
+                if (unit.suffix != suffix) continue;
+                if (number > max / unit.factor) return std::nullopt;
+                return number * unit.factor;
+            }
+            return std::nullopt;
+        }
+
+        // Writes value in the largest unit which divides it without remainder.
+        template<std::size_t N>
+        void PrintWithUnit(std::ostream& os, std::uint64_t value, std::array<Unit, N> const& units){
+            auto best = units[0];
+            for (auto const& unit : units){
+                if (value != 0 && value % unit.factor == 0 && unit.factor > best.factor) best = unit;
+            }
+            os << value / best.factor << best.suffix;
+        }
+    }
+
+    // A size in bytes, parsed from e.g. "512MiB", "4kB" or "100". SI and IEC suffixes are accepted.
+    class Bytes{
+        std::size_t value = 0;
+    public:
+        Bytes()=default;
+        constexpr explicit Bytes(std::size_t bytes):value(bytes){}
+        constexpr std::size_t Get()const{return value;}
+        constexpr bool operator==(Bytes const& other)const{
+            return value == other.value;
+        }
+
+        static auto FromString(std::string_view text) -> std::optional<Bytes>{
+            auto const bytes = Helpers::ParseWithUnit(text, Helpers::byte_units, std::numeric_limits<std::size_t>::max());
+            if (!bytes) return std::nullopt;
+            return Bytes(static_cast<std::size_t>(bytes.value()));
+        }
+    };
+
+    // A duration, parsed from e.g. "250ms" or "2h". The suffixes are ns, us, ms, s, min and h.
+    class Duration{
+        std::chrono::nanoseconds value{0};
+    public:
+        Duration()=default;
+        constexpr explicit Duration(std::chrono::nanoseconds duration):value(duration){}
+        constexpr std::chrono::nanoseconds Get()const{return value;}
+        template<typename ToDuration>
+        constexpr ToDuration As()const{
+            return std::chrono::duration_cast<ToDuration>(value);
+        }
+        constexpr bool operator==(Duration const& other)const{
+            return value == other.value;
+        }
+
+        static auto FromString(std::string_view text) -> std::optional<Duration>{
+            using Rep = std::chrono::nanoseconds::rep;
+            auto const nanoseconds = Helpers::ParseWithUnit(text, Helpers::duration_units, static_cast<std::uint64_t>(std::numeric_limits<Rep>::max()));
+            if (!nanoseconds) return std::nullopt;
+            return Duration(std::chrono::nanoseconds(static_cast<Rep>(nanoseconds.value())));
+        }
+    };
+
+    inline std::istream& operator>>(std::istream& is, Bytes& target){
+        std::string text;
+        if (is >> text){
+            if (auto const parsed = Bytes::FromString(text)) target = parsed.value();
+            else is.setstate(std::ios_base::failbit);
+        }
+        return is;
+    }
+
+    inline std::ostream& operator<<(std::ostream& os, Bytes const& target){
+        Helpers::PrintWithUnit(os, target.Get(), Helpers::byte_units);
+        return os;
+    }
+
+    inline std::istream& operator>>(std::istream& is, Duration& target){
+        std::string text;
+        if (is >> text){
+            if (auto const parsed = Duration::FromString(text)) target = parsed.value();
+            else is.setstate(std::ios_base::failbit);
+        }
+        return is;
+    }
+
+    inline std::ostream& operator<<(std::ostream& os, Duration const& target){
+        // negated as unsigned, which unlike std::chrono::abs also holds for nanoseconds::min()
+        auto const count = target.Get().count();
+        auto const magnitude = static_cast<std::uint64_t>(count);
+        if (count < 0) os << '-';
+        Helpers::PrintWithUnit(os, count < 0 ? 0 - magnitude : magnitude, Helpers::duration_units);
+        return os;
+    }
+
+    // Appends the valid choices of an Enum to the description shown in the help.
+    template<typename Type>
+    struct DescriptionWithChoices{
+        static auto get(Description const& description) -> std::string{
+            return description.Get();
+        }
+    };
+
+    template<typename Type>
+    struct DescriptionWithChoices<std::optional<Type>>: DescriptionWithChoices<Type>{};
+
+    template<typename T, typename TypeTag>
+    struct DescriptionWithChoices<CheckedCmdTypesafe::Typesafe<T, TypeTag>>: DescriptionWithChoices<T>{};
+
+    template<typename E, typename Names, EnumCase Case>
+    struct DescriptionWithChoices<Enum<E, Names, Case>>{
+        static auto get(Description const& description) -> std::string{
+            auto const choices = "(" + Enum<E, Names, Case>::Choices() + ")";
+            return description.Get().empty() ? choices : description.Get() + " " + choices;
+        }
+    };
+
     template<typename Type>
     struct ClaraArgBinder;
 
@@ -89,13 +522,22 @@ namespace CheckedCmd{
     template<typename Type>
     struct ClaraParamBinder;
 
+    template<typename Descriptor>
+    struct RegistryBinder;
+
+    // clara rejects empty option names, so only the given ones are passed on.
+    inline auto ClaraOptNames(clara::Opt opt, ShortName const& short_name, LongName const& long_name) -> clara::Opt{
+        if (!short_name.Get().empty()) opt[short_name.Get()];
+        if (!long_name.Get().empty()) opt[long_name.Get()];
+        return opt;
+    }
+
     template<typename TypeTag>
     class Flag{};
     template<typename TypeTag>
     struct ClaraFlagBinder<CheckedCmdTypesafe::Typesafe<bool, TypeTag>>{
         static clara::Parser bind(clara::Parser const& parser, Flag<CheckedCmdTypesafe::Typesafe<bool,TypeTag>>& t){
-            return parser|clara::Opt(t.boolval)
-            [t.GetShortName().Get()][t.GetName().Get()]
+            return parser|ClaraOptNames(clara::Opt(t.boolval), t.GetShortName(), t.GetName())
                     (t.GetDescription().Get());
         }
 
@@ -105,11 +547,17 @@ namespace CheckedCmd{
     template<typename TypeTag>
     class Flag<CheckedCmdTypesafe::Typesafe<bool, TypeTag>>{
     public:
+        template<typename Tag = TypeTag, typename = std::enable_if_t<!has_static_names<Tag>::value>>
         Flag( ShortName short_name_, LongName long_name_, Description description_)
         :description(std::move(description_))
         ,short_name(std::move(short_name_))
         ,longName(std::move(long_name_)){}
 
+        explicit Flag(Description description_)
+        :description(std::move(description_))
+        ,short_name(StaticShortName<TypeTag>())
+        ,longName(StaticLongName<TypeTag>()){}
+
         auto value()const -> CheckedCmdTypesafe::Typesafe<bool, TypeTag>{
             return CheckedCmdTypesafe::Typesafe<bool, TypeTag>(boolval);
         }
@@ -129,8 +577,17 @@ namespace CheckedCmd{
         bool IsInValid()const{
             return false;
         }
+
+        bool HasSameValue(Flag const& other)const{
+            return boolval == other.boolval;
+        }
+
+        void Reset(){
+            boolval = false;
+        }
     private:
         friend struct ClaraFlagBinder<CheckedCmdTypesafe::Typesafe<bool, TypeTag>>;
+        friend struct RegistryBinder<Flag<CheckedCmdTypesafe::Typesafe<bool, TypeTag>>>;
         Description description;
         ShortName short_name;
         LongName longName;
@@ -174,6 +631,7 @@ namespace CheckedCmd{
     template<typename Type>
     class Param: public ParamBase {
     public:
+        template<typename Tag = typename TagOf<Type>::type, typename = std::enable_if_t<!has_static_names<Tag>::value>>
         Param(Hint hint_, ShortName short_name_, LongName long_name_, Description description_, std::function<bool(Type)> pred)
                 :ParamBase(std::move(hint_)
                            ,std::move(short_name_)
@@ -183,6 +641,15 @@ namespace CheckedCmd{
                  ,predicate(pred)
                  {}
 
+        Param(Hint hint_, Description description_, std::function<bool(Type)> pred)
+                :ParamBase(std::move(hint_)
+                           ,StaticShortName<typename TagOf<Type>::type>()
+                           ,StaticLongName<typename TagOf<Type>::type>()
+                           ,std::move(description_)
+                          )
+                 ,predicate(pred)
+                 {}
+
         auto value()const -> Type const&{
             return val;
         }
@@ -191,9 +658,18 @@ namespace CheckedCmd{
             return !predicate(val);
         }
 
+        bool HasSameValue(Param const& other)const{
+            return val == other.val;
+        }
+
+        void Reset(){
+            val = decltype(val){};
+        }
+
     private:
         friend struct ClaraParamBinder<Type>;
-        Type val;
+        friend struct RegistryBinder<Param<Type>>;
+        Type val{};
         std::function<bool(Type)> predicate;
     };
 
@@ -221,9 +697,18 @@ namespace CheckedCmd{
         bool IsInValid()const{
             return !predicate(val);
         }
+
+        bool HasSameValue(Arg const& other)const{
+            return val == other.val;
+        }
+
+        void Reset(){
+            val = decltype(val){};
+        }
     private:
         friend struct ClaraArgBinder<Type>;
-        Type val;
+        friend struct RegistryBinder<Arg<Type>>;
+        Type val{};
         Description description;
         Hint hint;
         std::function<bool(Type)> predicate;
@@ -233,16 +718,15 @@ namespace CheckedCmd{
     template<typename T>
     struct ClaraArgBinder{
         static clara::Parser bind(clara::Parser const& parser, Arg<T>& t){
-            return parser|clara::Arg(t.val,t.GetHint().Get())(t.GetDescription().Get());
+            return parser|clara::Arg(t.val,t.GetHint().Get())(DescriptionWithChoices<T>::get(t.GetDescription()));
         }
     };
 
     template<typename T>
     struct ClaraParamBinder{
         static clara::Parser bind(clara::Parser const& parser, Param<T>& t){
-            return parser|clara::Opt(t.val,t.GetHint().Get())
-                          [t.GetShortName().Get()][t.GetName().Get()]
-                          (t.GetDescription().Get()).required();
+            return parser|ClaraOptNames(clara::Opt(t.val,t.GetHint().Get()), t.GetShortName(), t.GetName())
+                          (DescriptionWithChoices<T>::get(t.GetDescription())).required();
         }
     };
 
@@ -271,19 +755,28 @@ namespace CheckedCmd{
         bool IsInValid() const{
             return false;
         };
+
+        bool HasSameValue(Flag const& other)const{
+            return helpval == other.helpval;
+        }
+
+        void Reset(){
+            helpval = false;
+            description = Description("");
+        }
     private:
         friend struct ClaraFlagBinder<HelpFlag>;
+        friend struct RegistryBinder<Flag<HelpFlag>>;
         Description description = Description("");
-        ShortName short_name = ShortName("-h");
-        LongName longName = LongName("--help");
+        ShortName short_name = StaticShortName<TypeTagHelpFlag>();
+        LongName longName = StaticLongName<TypeTagHelpFlag>();
         bool helpval=false;
     };
 
     template<>
     struct ClaraFlagBinder<HelpFlag>{
         static clara::Parser bind(clara::Parser const& parser, Flag<HelpFlag>& t){
-            return parser|clara::Opt(t.helpval)
-            [t.GetShortName().Get()][t.GetName().Get()]
+            return parser|ClaraOptNames(clara::Opt(t.helpval), t.GetShortName(), t.GetName())
                     (t.GetDescription().Get());
         }
     };
@@ -292,6 +785,7 @@ namespace CheckedCmd{
     template<typename Type>
     class Param<std::optional< Type>>: public ParamBase{
     public:
+        template<typename Tag = typename TagOf<Type>::type, typename = std::enable_if_t<!has_static_names<Tag>::value>>
         Param( Hint hint_, ShortName short_name_, LongName long_name_, Description description_, std::function<bool(Type)> pred)
                 :ParamBase(std::move(hint_)
                            ,std::move(short_name_)
@@ -301,6 +795,15 @@ namespace CheckedCmd{
                  ,predicate(pred)
                  {}
 
+        Param(Hint hint_, Description description_, std::function<bool(Type)> pred)
+                :ParamBase(std::move(hint_)
+                           ,StaticShortName<typename TagOf<Type>::type>()
+                           ,StaticLongName<typename TagOf<Type>::type>()
+                           ,std::move(description_)
+                          )
+                 ,predicate(pred)
+                 {}
+
         auto value_or(Type val_)const -> Type{
             return (val.has_value())?val.value():val_;
         }
@@ -316,8 +819,17 @@ namespace CheckedCmd{
         bool IsInValid()const{
             return val.has_value() && !predicate(val.value());
         };
+
+        bool HasSameValue(Param const& other)const{
+            return val == other.val;
+        }
+
+        void Reset(){
+            val = decltype(val){};
+        }
     private:
         friend struct ClaraParamBinder<std::optional<Type>>;
+        friend struct RegistryBinder<Param<std::optional<Type>>>;
         std::optional< Type> val;
         std::function<bool(Type)> predicate;
     };
@@ -325,6 +837,7 @@ namespace CheckedCmd{
     template<typename TypeTag>
     class Param<std::optional< CheckedCmdTypesafe::Typesafe<char, TypeTag>>>: public ParamBase{
     public:
+        template<typename Tag = TypeTag, typename = std::enable_if_t<!has_static_names<Tag>::value>>
         Param( Hint hint_, ShortName short_name_, LongName long_name_, Description description_, std::function<bool(char)> pred)
                 :ParamBase(std::move(hint_)
                 ,std::move(short_name_)
@@ -334,6 +847,15 @@ namespace CheckedCmd{
                  ,predicate(pred)
         {}
 
+        Param(Hint hint_, Description description_, std::function<bool(char)> pred)
+                :ParamBase(std::move(hint_)
+                           ,StaticShortName<TypeTag>()
+                           ,StaticLongName<TypeTag>()
+                           ,std::move(description_)
+                          )
+                 ,predicate(pred)
+                 {}
+
         auto value_or(CheckedCmdTypesafe::Typesafe<char, TypeTag> val_)const -> CheckedCmdTypesafe::Typesafe<char, TypeTag>{
             if(val.has_value()) {
                 if (std::regex_match(val.value(), std::regex(R"(^.$)"))) {
@@ -377,8 +899,17 @@ namespace CheckedCmd{
             }
             return true;
         }
+
+        bool HasSameValue(Param const& other)const{
+            return val == other.val;
+        }
+
+        void Reset(){
+            val = decltype(val){};
+        }
     private:
         friend  struct ClaraParamBinder<std::optional<CheckedCmdTypesafe::Typesafe<char, TypeTag>>>;
+        friend  struct RegistryBinder<Param<std::optional<CheckedCmdTypesafe::Typesafe<char, TypeTag>>>>;
         std::optional< std::string> val;
         std::function<bool(char)> predicate;
     };
@@ -386,6 +917,7 @@ namespace CheckedCmd{
     template<typename TypeTag>
     class Param<CheckedCmdTypesafe::Typesafe<char, TypeTag>>: public ParamBase{
     public:
+        template<typename Tag = TypeTag, typename = std::enable_if_t<!has_static_names<Tag>::value>>
         Param( Hint hint_, ShortName short_name_, LongName long_name_, Description description_, std::function<bool(char)> pred)
                 :ParamBase(std::move(hint_)
                 ,std::move(short_name_)
@@ -395,6 +927,15 @@ namespace CheckedCmd{
                  ,predicate(pred)
         {}
 
+        Param(Hint hint_, Description description_, std::function<bool(char)> pred)
+                :ParamBase(std::move(hint_)
+                           ,StaticShortName<TypeTag>()
+                           ,StaticLongName<TypeTag>()
+                           ,std::move(description_)
+                          )
+                 ,predicate(pred)
+                 {}
+
         auto value()const -> CheckedCmdTypesafe::Typesafe<char, TypeTag>{
             if (std::regex_match(val, std::regex(R"(^'.'$)"))) {
                 return CheckedCmdTypesafe::Typesafe<char, TypeTag>(val[1]);
@@ -417,8 +958,17 @@ namespace CheckedCmd{
             }
             return true;
         }
+
+        bool HasSameValue(Param const& other)const{
+            return val == other.val;
+        }
+
+        void Reset(){
+            val = decltype(val){};
+        }
     private:
         friend  struct ClaraParamBinder<CheckedCmdTypesafe::Typesafe<char, TypeTag>>;
+        friend  struct RegistryBinder<Param<CheckedCmdTypesafe::Typesafe<char, TypeTag>>>;
         std::string val;
         std::function<bool(char)> predicate;
     };
@@ -426,8 +976,7 @@ namespace CheckedCmd{
     template<typename TypeTag>
     struct ClaraParamBinder<std::optional<CheckedCmdTypesafe::Typesafe<char, TypeTag>>>{
         static clara::Parser bind(clara::Parser const& parser, Param<std::optional<CheckedCmdTypesafe::Typesafe<char, TypeTag>>>& t){
-            return parser|clara::Opt(t.val,t.GetHint().Get())
-            [t.GetShortName().Get()][t.GetName().Get()]
+            return parser|ClaraOptNames(clara::Opt(t.val,t.GetHint().Get()), t.GetShortName(), t.GetName())
                     (t.GetDescription().Get());
         }
     };
@@ -435,8 +984,7 @@ namespace CheckedCmd{
     template<typename TypeTag>
     struct ClaraParamBinder<CheckedCmdTypesafe::Typesafe<char, TypeTag>>{
         static clara::Parser bind(clara::Parser const& parser, Param<CheckedCmdTypesafe::Typesafe<char, TypeTag>>& t){
-            return parser|clara::Opt(t.val,t.GetHint().Get())
-            [t.GetShortName().Get()][t.GetName().Get()]
+            return parser|ClaraOptNames(clara::Opt(t.val,t.GetHint().Get()), t.GetShortName(), t.GetName())
                     (t.GetDescription().Get()).required();
         }
     };
@@ -444,9 +992,8 @@ namespace CheckedCmd{
     template<typename Type>
     struct ClaraParamBinder<std::optional<Type>>{
         static clara::Parser bind(clara::Parser const& parser, Param<std::optional<Type>>& t){
-            return parser|clara::Opt(t.val,t.GetHint().Get())
-            [t.GetShortName().Get()][t.GetName().Get()]
-                    (t.GetDescription().Get());
+            return parser|ClaraOptNames(clara::Opt(t.val,t.GetHint().Get()), t.GetShortName(), t.GetName())
+                    (DescriptionWithChoices<Type>::get(t.GetDescription()));
         }
     };
 
@@ -484,6 +1031,99 @@ namespace CheckedCmd{
     template <typename T, typename... Us>
     struct has_type<T, std::tuple<Us...>> : std::disjunction<std::is_same<T, Us>...> {};
 
+    template <typename T, typename Tuple>
+    struct count_of;
+
+    template <typename T, typename... Us>
+    struct count_of<T, std::tuple<Us...>> : std::integral_constant<std::size_t, (std::size_t{0} + ... + std::is_same<T, Us>::value)> {};
+
+    template<typename Descriptor>
+    struct is_arg : std::false_type {};
+
+    template<typename Type>
+    struct is_arg<Arg<Type>> : std::true_type {};
+
+    template<typename Descriptor>
+    struct DescriptorTag{
+        using type = void;
+    };
+
+    template<typename Type>
+    struct DescriptorTag<Param<Type>>: TagOf<Type>{};
+
+    template<typename Type>
+    struct DescriptorTag<Flag<Type>>: TagOf<Type>{};
+
+    template<typename Type>
+    struct DescriptorTag<Arg<Type>>: TagOf<Type>{};
+
+    // The option names of a tuple of descriptors, as far as their TypeTags provide them.
+    template<typename Tuple>
+    struct StaticNames;
+
+    template<typename... Descriptors>
+    struct StaticNames<std::tuple<Descriptors...>>{
+        struct Collected{
+            std::array<std::string_view, 2 * sizeof...(Descriptors)> names{};
+            std::size_t count = 0;
+        };
+
+        template<typename Descriptor>
+        static constexpr void Add(Collected& collected){
+            using TypeTag = typename DescriptorTag<Descriptor>::type;
+            if constexpr (has_static_names<TypeTag>::value && !is_arg<Descriptor>::value){
+                collected.names[collected.count++] = TypeTag::short_name;
+                collected.names[collected.count++] = TypeTag::long_name;
+            }
+        }
+
+        static constexpr Collected Collect(){
+            Collected collected{};
+            (Add<Descriptors>(collected), ...);
+            return collected;
+        }
+
+        // An empty name is left out.
+        static constexpr bool IsWellFormed(std::string_view name){
+            return name.empty() || Helpers::IsOptionName(name);
+        }
+
+        // Names are collected in pairs, short name first.
+        static constexpr bool AreWellFormed(){
+            auto const collected = Collect();
+            for (std::size_t i = 0; i < collected.count; i += 2){
+                auto const short_name = collected.names[i];
+                auto const long_name  = collected.names[i + 1];
+                if (short_name.empty() && long_name.empty()) return false;
+                if (!IsWellFormed(short_name) || !IsWellFormed(long_name)) return false;
+            }
+            return true;
+        }
+
+        static constexpr bool AreDistinct(){
+            auto const collected = Collect();
+            for (std::size_t i = 0; i < collected.count; ++i){
+                if (collected.names[i].empty()) continue;
+                for (std::size_t j = 0; j < i; ++j){
+                    if (collected.names[i] == collected.names[j]) return false;
+                }
+            }
+            return true;
+        }
+
+        static constexpr bool ArgsAreUnnamed(){
+            return (... && !(is_arg<Descriptors>::value && has_static_names<typename DescriptorTag<Descriptors>::type>::value));
+        }
+    };
+
+    template<typename ARG_TUPLE>
+    constexpr void AssertValidNames(){
+        static_assert(count_of<Help, ARG_TUPLE>::value <= 1, "Help must not be declared twice");
+        static_assert(StaticNames<ARG_TUPLE>::ArgsAreUnnamed(), "an Arg is positional and must not have option names");
+        static_assert(StaticNames<ARG_TUPLE>::AreWellFormed(), "option names must start with '-', must not be \"--\" or contain ' ', ':' or '=', and one of short and long name must be given");
+        static_assert(StaticNames<ARG_TUPLE>::AreDistinct(), "option names must be distinct");
+    }
+
     template<typename Tuple>
     constexpr bool IsInvalid(Tuple const& tuple){
         constexpr auto is_invalid = [](auto const&...  args) {
@@ -496,14 +1136,43 @@ namespace CheckedCmd{
         return !(parser_result);
     };
 
-    template<typename ARG_TUPLE>
-    auto ParseCmdArgsTuple(int argc, char**argv , ARG_TUPLE arg)-> std::optional<ARG_TUPLE>{
-        auto const parser = BindToClara(arg);
-        auto const result = parser.parse(clara::Args(argc, argv));
+    template <typename T, typename Tuple>
+    struct index_of;
 
-        if (IsParseError(result) || IsInvalid(arg))
-            return std::nullopt;
+    template <typename T, typename... Us>
+    struct index_of<T, std::tuple<T, Us...>> : std::integral_constant<std::size_t, 0> {};
 
+    template <typename T, typename U, typename... Us>
+    struct index_of<T, std::tuple<U, Us...>> : std::integral_constant<std::size_t, 1 + index_of<T, std::tuple<Us...>>::value> {};
+
+    template<typename Tuple>
+    using OptionSet = std::bitset<std::tuple_size<Tuple>::value>;
+
+    template<typename Tuple>
+    bool IsInvalid(Tuple const& tuple, OptionSet<Tuple> const& selected){
+        return Helpers::detail::index_apply<std::tuple_size<Tuple>::value>([&](auto... Is){
+            return (... || (selected.test(Is) && std::get<Is>(tuple).IsInValid()));
+        });
+    }
+
+    template<typename Tuple>
+    auto ChangedOptions(Tuple const& current, Tuple const& previous){
+        OptionSet<Tuple> changed;
+        Helpers::detail::index_apply<std::tuple_size<Tuple>::value>([&](auto... Is){
+            (changed.set(Is, !std::get<Is>(current).HasSameValue(std::get<Is>(previous))), ...);
+        });
+        return changed;
+    }
+
+    template<typename Tuple>
+    void ResetValues(Tuple& tuple){
+        Helpers::detail::index_apply<std::tuple_size<Tuple>::value>([&](auto... Is){
+            (std::get<Is>(tuple).Reset(), ...);
+        });
+    }
+
+    template<typename ARG_TUPLE>
+    void SetHelpDescription(clara::Parser const& parser, ARG_TUPLE& arg){
         if constexpr (has_type<Help, ARG_TUPLE>::value){
             if(std::get<Help>(arg).value()){
                 std::ostringstream oss;
@@ -511,9 +1180,55 @@ namespace CheckedCmd{
                 std::get<Help>(arg).SetDescription(Description(oss.str()));
             }
         }
+    }
+
+    template<typename ARG_TUPLE>
+    auto ParseCmdArgsTuple(int argc, char**argv , ARG_TUPLE arg)-> std::optional<ARG_TUPLE>{
+        AssertValidNames<ARG_TUPLE>();
+        auto const parser = BindToClara(arg);
+        auto const result = parser.parse(clara::Args(argc, argv));
+
+        if (IsParseError(result) || IsInvalid(arg))
+            return std::nullopt;
+
+        SetHelpDescription(parser, arg);
         return arg;
     }
 
+    template<typename ARG_TUPLE>
+    struct Reparsed{
+        ARG_TUPLE args;
+        OptionSet<ARG_TUPLE> changed;
+
+        template<typename T>
+        bool HasChanged()const{
+            static_assert(count_of<T, ARG_TUPLE>::value == 1, "HasChanged needs a descriptor type which appears exactly once");
+            return changed.test(index_of<T, ARG_TUPLE>::value);
+        }
+    };
+
+    // Parses argv again for a tuple which was parsed successfully before, e.g. on a configuration reload.
+    // The values of 'previous' are reset first, so options missing from the new argv get their defaults.
+    // Only the checks of options whose value differs from 'previous' are called again.
+    template<typename ARG_TUPLE>
+    auto ReparseCmdArgsTuple(int argc, char**argv, ARG_TUPLE const& previous)-> std::optional<Reparsed<ARG_TUPLE>>{
+        AssertValidNames<ARG_TUPLE>();
+        auto arg = previous;
+        ResetValues(arg);
+        auto const parser = BindToClara(arg);
+        auto const result = parser.parse(clara::Args(argc, argv));
+
+        if (IsParseError(result))
+            return std::nullopt;
+
+        auto const changed = ChangedOptions(arg, previous);
+        if (IsInvalid(arg, changed))
+            return std::nullopt;
+
+        SetHelpDescription(parser, arg);
+        return Reparsed<ARG_TUPLE>{std::move(arg), changed};
+    }
+
     template<typename ... ARGS>
     auto ParseCmd(int argc, char**argv, ARGS&& ... args){
         return ParseCmdArgsTuple(argc, argv, Helpers::reverse(std::make_tuple( args ...)));
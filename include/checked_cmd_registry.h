@@ -0,0 +1,358 @@
+#ifndef CHECKED_CMD_REGISTRY_H
+#define CHECKED_CMD_REGISTRY_H
+#include <checked_cmd.h>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace CheckedCmd{
+    namespace Helpers{
+        // Maps option names to option indices. Open addressing with linear probing,
+        // the capacity is a power of two and kept at least twice the number of names.
+        class NameTable{
+        public:
+            static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+            auto Find(std::string_view name)const -> std::size_t{
+                if (slots.empty()) return npos;
+                auto const hash = Fnv1a(name);
+                for (auto pos = Home(hash);; pos = Next(pos)){
+                    auto const& slot = slots[pos];
+                    if (slot.index == npos) return npos;
+                    if (slot.hash == hash && slot.name == name) return slot.index;
+                }
+            }
+
+            bool Insert(std::string_view name, std::size_t index){
+                if (Find(name) != npos) return false;
+                if ((count + 1) * 2 > slots.size()) Grow();
+                Place(Slot{Fnv1a(name), std::string(name), index});
+                ++count;
+                return true;
+            }
+
+            auto size()const -> std::size_t{
+                return count;
+            }
+        private:
+            struct Slot{
+                std::uint64_t hash = 0;
+                std::string name;
+                std::size_t index = npos;
+            };
+
+            auto Home(std::uint64_t hash)const -> std::size_t{
+                return static_cast<std::size_t>(hash) & (slots.size() - 1);
+            }
+
+            auto Next(std::size_t pos)const -> std::size_t{
+                return (pos + 1) & (slots.size() - 1);
+            }
+
+            void Place(Slot slot){
+                auto pos = Home(slot.hash);
+                while (slots[pos].index != npos) pos = Next(pos);
+                slots[pos] = std::move(slot);
+            }
+
+            void Grow(){
+                auto old = std::exchange(slots, std::vector<Slot>(slots.empty() ? 16 : slots.size() * 2));
+                for (auto& slot : old){
+                    if (slot.index != npos) Place(std::move(slot));
+                }
+            }
+
+            std::vector<Slot> slots;
+            std::size_t count = 0;
+        };
+
+        template<typename T, typename = void>
+        struct parses_itself : std::false_type {};
+
+        template<typename T>
+        struct parses_itself<T, std::void_t<decltype(T::FromString(std::string_view()))>> : std::true_type {};
+
+        // Same conversion rules as clara: strings are taken as a whole, everything else goes
+        // through operator>>, except for types which parse themselves (Enum, Bytes, Duration).
+        inline bool ConvertInto(std::string const& source, std::string& target){
+            target = source;
+            return true;
+        }
+        inline bool ConvertInto(std::string const& source, bool& target){
+            auto const is_any_of = [&source](auto... words){ return (... || Equals(source, words, true)); };
+            if (is_any_of("y", "1", "true", "yes", "on"))       target = true;
+            else if (is_any_of("n", "0", "false", "no", "off")) target = false;
+            else return false;
+            return true;
+        }
+        template<typename T>
+        bool ConvertInto(std::string const& source, T& target){
+            if constexpr (parses_itself<T>::value){
+                auto const parsed = T::FromString(source);
+                if (parsed) target = parsed.value();
+                return parsed.has_value();
+            }
+            else{
+                std::stringstream ss(source);
+                ss >> target;
+                return !ss.fail();
+            }
+        }
+        template<typename T, typename TypeTag>
+        bool ConvertInto(std::string const& source, CheckedCmdTypesafe::Typesafe<T, TypeTag>& target){
+            if constexpr (parses_itself<T>::value){
+                T temp;
+                if (!ConvertInto(source, temp)) return false;
+                target = CheckedCmdTypesafe::Typesafe<T, TypeTag>(temp);
+                return true;
+            }
+            else{
+                std::stringstream ss(source);
+                ss >> target;
+                return !ss.fail();
+            }
+        }
+        template<typename T>
+        bool ConvertInto(std::string const& source, std::optional<T>& target){
+            T temp;
+            if (!ConvertInto(source, temp)) return false;
+            target = std::move(temp);
+            return true;
+        }
+
+        struct Token{
+            bool is_option;
+            std::string text;
+        };
+
+        // Splits argv the way clara's TokenStream does: empty entries are skipped, "-o=value",
+        // "-o:value" and "-o value" become an option and an argument, and bundled short flags
+        // like "-Hx" become "-H" and "-x".
+        inline auto Tokenize(int argc, char** argv) -> std::vector<Token>{
+            std::vector<Token> tokens;
+            for (int i = 1; i < argc; ++i){
+                std::string_view const arg(argv[i]);
+                if (arg.empty()) continue;
+                if (arg[0] != '-'){
+                    tokens.push_back({false, std::string(arg)});
+                    continue;
+                }
+                auto const delimiter = arg.find_first_of(" :=");
+                if (delimiter != std::string_view::npos){
+                    tokens.push_back({true,  std::string(arg.substr(0, delimiter))});
+                    tokens.push_back({false, std::string(arg.substr(delimiter + 1))});
+                }
+                else if (arg.size() > 2 && arg[1] != '-'){
+                    for (auto c : arg.substr(1)) tokens.push_back({true, std::string{'-', c}});
+                }
+                else{
+                    tokens.push_back({true, std::string(arg)});
+                }
+            }
+            return tokens;
+        }
+
+        inline auto OptionUsage(ShortName const& short_name, LongName const& long_name, std::string const& hint){
+            auto usage = short_name.Get();
+            if (!usage.empty() && !long_name.Get().empty()) usage += ", ";
+            usage += long_name.Get();
+            if (!hint.empty()) usage += " <" + hint + ">";
+            return usage;
+        }
+    }
+
+    template<typename T>
+    struct is_optional : std::false_type {};
+
+    template<typename T>
+    struct is_optional<std::optional<T>> : std::true_type {};
+
+    // Collects Param, Flag and Arg descriptors at runtime, e.g. from plugins while they are loaded,
+    // and parses argv for all of them in one pass. Descriptors are referenced, not copied:
+    // they must outlive the registry and stay where they are after registration.
+    // Each call of Parse starts from the default values, so it can be called again e.g. on a reload.
+    class Registry{
+    public:
+        template<typename Descriptor>
+        bool Register(Descriptor& descriptor){
+            return RegistryBinder<Descriptor>::bind(*this, descriptor);
+        }
+
+        bool Parse(int argc, char** argv);
+
+        auto Usage()const -> std::string;
+
+        auto size()const -> std::size_t{
+            return options.size();
+        }
+    private:
+        template<typename Descriptor>
+        friend struct RegistryBinder;
+
+        enum class Kind{Flag, Param, Arg};
+        struct Option{
+            Kind kind;
+            bool required;
+            std::string usage;
+            std::string description;
+            std::function<bool(std::string const&)> assign;
+            std::function<bool()> is_invalid;
+            std::function<void()> reset;
+        };
+
+        bool AddOption(ShortName const& short_name, LongName const& long_name, Option option);
+        void AddPositional(Option option);
+
+        std::vector<Option> options;
+        std::vector<std::size_t> positionals;
+        Helpers::NameTable names;
+        Flag<HelpFlag>* help = nullptr;
+    };
+
+    template<typename Type>
+    struct RegistryBinder<Param<Type>>{
+        static bool bind(Registry& registry, Param<Type>& t){
+            return registry.AddOption(t.GetShortName(), t.GetName()
+                                      ,{Registry::Kind::Param
+                                        ,!is_optional<Type>::value
+                                        ,Helpers::OptionUsage(t.GetShortName(), t.GetName(), t.GetHint().Get())
+                                        ,DescriptionWithChoices<Type>::get(t.GetDescription())
+                                        ,[&t](std::string const& source){ return Helpers::ConvertInto(source, t.val); }
+                                        ,[&t]{ return t.IsInValid(); }
+                                        ,[&t]{ t.Reset(); }
+                                       });
+        }
+    };
+
+    template<typename Type>
+    struct RegistryBinder<Arg<Type>>{
+        static bool bind(Registry& registry, Arg<Type>& t){
+            registry.AddPositional({Registry::Kind::Arg
+                                    ,false
+                                    ,"<" + t.GetHint().Get() + ">"
+                                    ,DescriptionWithChoices<Type>::get(t.GetDescription())
+                                    ,[&t](std::string const& source){ return Helpers::ConvertInto(source, t.val); }
+                                    ,[&t]{ return t.IsInValid(); }
+                                    ,[&t]{ t.Reset(); }
+                                   });
+            return true;
+        }
+    };
+
+    template<typename TypeTag>
+    struct RegistryBinder<Flag<CheckedCmdTypesafe::Typesafe<bool, TypeTag>>>{
+        static bool bind(Registry& registry, Flag<CheckedCmdTypesafe::Typesafe<bool, TypeTag>>& t){
+            return registry.AddOption(t.GetShortName(), t.GetName()
+                                      ,{Registry::Kind::Flag
+                                        ,false
+                                        ,Helpers::OptionUsage(t.GetShortName(), t.GetName(), "")
+                                        ,t.GetDescription().Get()
+                                        ,[&t](std::string const&){ t.boolval = true; return true; }
+                                        ,[&t]{ return t.IsInValid(); }
+                                        ,[&t]{ t.Reset(); }
+                                       });
+        }
+    };
+
+    template<>
+    struct RegistryBinder<Flag<HelpFlag>>{
+        static bool bind(Registry& registry, Flag<HelpFlag>& t){
+            if (registry.help) return false;
+            auto const added = registry.AddOption(t.GetShortName(), t.GetName()
+                                                  ,{Registry::Kind::Flag
+                                                    ,false
+                                                    ,Helpers::OptionUsage(t.GetShortName(), t.GetName(), "")
+                                                    ,t.GetDescription().Get()
+                                                    ,[&t](std::string const&){ t.helpval = true; return true; }
+                                                    ,[&t]{ return t.IsInValid(); }
+                                                    ,[&t, description = t.GetDescription()]{
+                                                        t.Reset();
+                                                        t.SetDescription(description);
+                                                     }
+                                                   });
+            if (added) registry.help = &t;
+            return added;
+        }
+    };
+
+    inline bool Registry::AddOption(ShortName const& short_name, LongName const& long_name, Option option){
+        auto const& short_str = short_name.Get();
+        auto const& long_str  = long_name.Get();
+        auto const has_short  = !short_str.empty();
+        auto const has_long   = !long_str.empty();
+
+        if (!has_short && !has_long) return false;
+        if ((has_short && !Helpers::IsOptionName(short_str)) || (has_long && !Helpers::IsOptionName(long_str))) return false;
+        if (has_short && has_long && short_str == long_str) return false;
+        if ((has_short && names.Find(short_str) != Helpers::NameTable::npos)
+            || (has_long && names.Find(long_str) != Helpers::NameTable::npos))
+            return false;
+
+        auto const index = options.size();
+        if (has_short) names.Insert(short_str, index);
+        if (has_long)  names.Insert(long_str, index);
+        options.push_back(std::move(option));
+        return true;
+    }
+
+    inline void Registry::AddPositional(Option option){
+        positionals.push_back(options.size());
+        options.push_back(std::move(option));
+    }
+
+    inline bool Registry::Parse(int argc, char** argv){
+        for (auto& option : options) option.reset();
+
+        std::vector<bool> seen(options.size(), false);
+        auto next_positional = positionals.begin();
+        auto const tokens = Helpers::Tokenize(argc, argv);
+
+        for (auto token = tokens.begin(); token != tokens.end(); ++token){
+            if (token->is_option){
+                auto const index = names.Find(token->text);
+                if (index == Helpers::NameTable::npos) return false;
+
+                auto& option = options[index];
+                if (option.kind == Kind::Flag){
+                    option.assign({});
+                }
+                else{
+                    if (++token == tokens.end() || token->is_option) return false;
+                    if (!option.assign(token->text)) return false;
+                }
+                seen[index] = true;
+            }
+            else{
+                if (next_positional == positionals.end()) return false;
+                if (!options[*next_positional].assign(token->text)) return false;
+                seen[*next_positional++] = true;
+            }
+        }
+
+        // asking for help needs neither the required options nor valid values
+        if (help && help->value()){
+            help->SetDescription(Description(Usage()));
+            return true;
+        }
+
+        for (std::size_t index = 0; index < options.size(); ++index){
+            if ((options[index].required && !seen[index]) || options[index].is_invalid())
+                return false;
+        }
+        return true;
+    }
+
+    inline auto Registry::Usage()const -> std::string{
+        std::ostringstream oss;
+        for (auto const& option : options){
+            oss << "  " << option.usage << "\n";
+            if (!option.description.empty()) oss << "        " << option.description << "\n";
+        }
+        return oss.str();
+    }
+}
+
+#endif //CHECKED_CMD_REGISTRY_H